@@ -20,11 +20,6 @@ static uint8_t hue;
 static uint8_t sat;
 static uint8_t val;
 static uint8_t rgb_mode;
-
-static char hue_buf[4];
-static char sat_buf[4];
-static char val_buf[4];
-static char mode_buf[4];
 // --------------------------------------------------------------
 
 #include "oled_render.h"
@@ -58,17 +53,14 @@ bool oled_task_user(void) {
     if (is_keyboard_master()) {
         oled_set_cursor(0,1);
         master_render_ghost();
-        oled_set_cursor(0,6);
-        render_layer();
-        oled_set_cursor(0,11);
-        render_hsv();
+        render_layer(6);
+        render_hsv(11);
     }
     // slave OLED: animation + mode
     else {
         oled_set_cursor(0,1);
         slave_render_ghost();
-        oled_set_cursor(0,13);
-        render_mode();
+        render_mode(13);
     }
 
     return false;
@@ -1,39 +1,59 @@
 // OLED rendering helpers kept separate to reduce keymap.c size.
 #pragma once
 
-static void format_3digits(uint8_t value, char out[4]) {
-    out[3] = '\0';
-    out[2] = '0' + value % 10;
-    value /= 10;
-    out[1] = '0' + value % 10;
-    out[0] = '0' + value / 10;
+// Fixed status strings and the digit strip are pre-rendered glcdfont
+// pages. This header defines the following PROGMEM arrays:
+//   raise_row[], base_row[], lower_row[], tune_row[],
+//   hue_label[], sat_label[], val_label[], mode_label[], digit_strip[]
+#include "oled_status_glyphs.h"
+
+// Blit one pre-rendered PROGMEM row to the given page. Raw writes do not
+// move the cursor, so each row positions it explicitly.
+static void write_row_P(uint8_t row, const char *data) {
+    oled_set_cursor(0, row);
+    oled_write_raw_P(data, STATUS_ROW_BYTES);
 }
 
-static void render_layer(void) {
-    oled_write_P(PSTR("RAISE"), layer_state_is(_RAISE) && !layer_state_is(_TUNE));
-    oled_write_P(PSTR("BASE\n"), layer_state_is(_BASE));
-    oled_write_P(PSTR("LOWER"), layer_state_is(_LOWER) && !layer_state_is(_TUNE));
-    oled_write_P(PSTR("TUNE\n"), layer_state_is(_TUNE));
+// Copy the three digits of value into out from the digit strip.
+static void compose_3digits(uint8_t value, char *out) {
+    memcpy_P(out + 2 * STATUS_GLYPH_BYTES, digit_strip[value % 10], STATUS_GLYPH_BYTES);
+    value /= 10;
+    memcpy_P(out + STATUS_GLYPH_BYTES, digit_strip[value % 10], STATUS_GLYPH_BYTES);
+    memcpy_P(out, digit_strip[value / 10], STATUS_GLYPH_BYTES);
 }
 
-static void render_mode(void) {
-    // Format the RGB mode number as a 3-digit ASCII string and print it.
-    format_3digits(rgb_mode, mode_buf);
-    oled_write("MODE  ", false);
-    oled_write(mode_buf, false);
+// Compose "<label>xxx" in RAM and blit it to the given page.
+static void write_value_row(uint8_t row, const char *label, uint8_t value) {
+    char buf[STATUS_ROW_BYTES] = {0};
+    memcpy_P(buf, label, 2 * STATUS_GLYPH_BYTES);
+    compose_3digits(value, buf + 2 * STATUS_GLYPH_BYTES);
+    oled_set_cursor(0, row);
+    oled_write_raw(buf, STATUS_ROW_BYTES);
 }
 
-// Print current Hue, Saturation and Value (HSV) to the OLED.
-static void render_hsv(void) {
-    oled_write("H ", false);
-    format_3digits(hue, hue_buf);
-    oled_write(hue_buf, false);
+// Print the layer names on four rows starting at row, inverting the
+// active one(s).
+static void render_layer(uint8_t row) {
+    write_row_P(row,     raise_row[layer_state_is(_RAISE) && !layer_state_is(_TUNE)]);
+    write_row_P(row + 1, base_row[layer_state_is(_BASE)]);
+    write_row_P(row + 2, lower_row[layer_state_is(_LOWER) && !layer_state_is(_TUNE)]);
+    write_row_P(row + 3, tune_row[layer_state_is(_TUNE)]);
+}
 
-    oled_write("S ", false);
-    format_3digits(sat, sat_buf);
-    oled_write(sat_buf, false);
+// Print the RGB mode label and its 3-digit number on two rows.
+static void render_mode(uint8_t row) {
+    // The number row starts with a blank glyph, matching "MODE  xxx"
+    // wrapped at five characters per line.
+    char buf[STATUS_ROW_BYTES] = {0};
+    compose_3digits(rgb_mode, buf + STATUS_GLYPH_BYTES);
+    write_row_P(row, mode_label);
+    oled_set_cursor(0, row + 1);
+    oled_write_raw(buf, STATUS_ROW_BYTES);
+}
 
-    oled_write("V ", false);
-    format_3digits(val, val_buf);
-    oled_write(val_buf, false);
+// Print current Hue, Saturation and Value (HSV) to the OLED.
+static void render_hsv(uint8_t row) {
+    write_value_row(row,     hue_label, hue);
+    write_value_row(row + 1, sat_label, sat);
+    write_value_row(row + 2, val_label, val);
 }
@@ -0,0 +1,82 @@
+// Pre-rendered status glyphs (stored in PROGMEM).
+// Each status row is one 32-byte OLED page rendered from the ASCII range
+// of glcdfont (6 bytes per character), so oled_render.h can blit a whole
+// row with a single raw write instead of looking up every character.
+
+#define STATUS_ROW_BYTES 32 // bytes per status row (one 32x8px page)
+#define STATUS_GLYPH_BYTES 6 // bytes per glcdfont character (5 columns + spacing)
+
+// Layer rows, indexed [normal, inverted].
+static const char PROGMEM raise_row[2][STATUS_ROW_BYTES] = {
+    { // 'RAISE' 32x8px
+        0x7f, 0x09, 0x19, 0x29, 0x46, 0x00, 0x7c, 0x12, 0x11, 0x12, 0x7c, 0x00, 0x00, 0x41, 0x7f, 0x41,
+        0x00, 0x00, 0x26, 0x49, 0x49, 0x49, 0x32, 0x00, 0x7f, 0x49, 0x49, 0x49, 0x41, 0x00, 0x00, 0x00
+    },
+    { // 'RAISE' inverted 32x8px
+        0x80, 0xf6, 0xe6, 0xd6, 0xb9, 0xff, 0x83, 0xed, 0xee, 0xed, 0x83, 0xff, 0xff, 0xbe, 0x80, 0xbe,
+        0xff, 0xff, 0xd9, 0xb6, 0xb6, 0xb6, 0xcd, 0xff, 0x80, 0xb6, 0xb6, 0xb6, 0xbe, 0xff, 0x00, 0x00
+    }
+};
+
+static const char PROGMEM base_row[2][STATUS_ROW_BYTES] = {
+    { // 'BASE' 32x8px
+        0x7f, 0x49, 0x49, 0x49, 0x36, 0x00, 0x7c, 0x12, 0x11, 0x12, 0x7c, 0x00, 0x26, 0x49, 0x49, 0x49,
+        0x32, 0x00, 0x7f, 0x49, 0x49, 0x49, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    { // 'BASE' inverted 32x8px
+        0x80, 0xb6, 0xb6, 0xb6, 0xc9, 0xff, 0x83, 0xed, 0xee, 0xed, 0x83, 0xff, 0xd9, 0xb6, 0xb6, 0xb6,
+        0xcd, 0xff, 0x80, 0xb6, 0xb6, 0xb6, 0xbe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    }
+};
+
+static const char PROGMEM lower_row[2][STATUS_ROW_BYTES] = {
+    { // 'LOWER' 32x8px
+        0x7f, 0x40, 0x40, 0x40, 0x40, 0x00, 0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x3f, 0x40, 0x38, 0x40,
+        0x3f, 0x00, 0x7f, 0x49, 0x49, 0x49, 0x41, 0x00, 0x7f, 0x09, 0x19, 0x29, 0x46, 0x00, 0x00, 0x00
+    },
+    { // 'LOWER' inverted 32x8px
+        0x80, 0xbf, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xbe, 0xbe, 0xbe, 0xc1, 0xff, 0xc0, 0xbf, 0xc7, 0xbf,
+        0xc0, 0xff, 0x80, 0xb6, 0xb6, 0xb6, 0xbe, 0xff, 0x80, 0xf6, 0xe6, 0xd6, 0xb9, 0xff, 0x00, 0x00
+    }
+};
+
+static const char PROGMEM tune_row[2][STATUS_ROW_BYTES] = {
+    { // 'TUNE' 32x8px
+        0x03, 0x01, 0x7f, 0x01, 0x03, 0x00, 0x3f, 0x40, 0x40, 0x40, 0x3f, 0x00, 0x7f, 0x04, 0x08, 0x10,
+        0x7f, 0x00, 0x7f, 0x49, 0x49, 0x49, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    { // 'TUNE' inverted 32x8px
+        0xfc, 0xfe, 0x80, 0xfe, 0xfc, 0xff, 0xc0, 0xbf, 0xbf, 0xbf, 0xc0, 0xff, 0x80, 0xfb, 0xf7, 0xef,
+        0x80, 0xff, 0x80, 0xb6, 0xb6, 0xb6, 0xbe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    }
+};
+
+// Two-character HSV labels; the three digits follow them on the same row.
+static const char PROGMEM hue_label[2 * STATUS_GLYPH_BYTES] = { // 'H ' 12x8px
+    0x7f, 0x08, 0x08, 0x08, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const char PROGMEM sat_label[2 * STATUS_GLYPH_BYTES] = { // 'S ' 12x8px
+    0x26, 0x49, 0x49, 0x49, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const char PROGMEM val_label[2 * STATUS_GLYPH_BYTES] = { // 'V ' 12x8px
+    0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const char PROGMEM mode_label[STATUS_ROW_BYTES] = { // 'MODE' 32x8px
+    0x7f, 0x02, 0x1c, 0x02, 0x7f, 0x00, 0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x7f, 0x41, 0x41, 0x41,
+    0x3e, 0x00, 0x7f, 0x49, 0x49, 0x49, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Digit strip '0'..'9' used to compose three-digit numbers.
+static const char PROGMEM digit_strip[10][STATUS_GLYPH_BYTES] = {
+    { 0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00 },
+    { 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00 },
+    { 0x72, 0x49, 0x49, 0x49, 0x46, 0x00 },
+    { 0x21, 0x41, 0x49, 0x4d, 0x33, 0x00 },
+    { 0x18, 0x14, 0x12, 0x7f, 0x10, 0x00 },
+    { 0x27, 0x45, 0x45, 0x45, 0x39, 0x00 },
+    { 0x3c, 0x4a, 0x49, 0x49, 0x31, 0x00 },
+    { 0x41, 0x21, 0x11, 0x09, 0x07, 0x00 },
+    { 0x36, 0x49, 0x49, 0x49, 0x36, 0x00 },
+    { 0x46, 0x49, 0x49, 0x29, 0x1e, 0x00 }
+};
@@ -65,7 +65,9 @@ def set_layer_wallpaper(image: Path) -> None:
         print(f"[{ts()}] [error] Failed to set wallpaper: {image}", file=sys.stderr)
 
 
-def refresh_layer_assets(startup: bool = False) -> None:
+# Returns keymap.h's mtime as left by the tidy step, so the watcher absorbs
+# only that write and not saves made during asset generation.
+def refresh_layer_assets(startup: bool = False) -> int | None:
     if startup:
         print(f"[{ts()}] Startup refresh: tidying and regenerating assets...")
     else:
@@ -76,6 +78,7 @@ def refresh_layer_assets(startup: bool = False) -> None:
         check=False,
         cwd=BASE_DIR,
     ).returncode
+    tidy_mtime = int(LAYER_SOURCE_FILE.stat().st_mtime) if LAYER_SOURCE_FILE.is_file() else None
     gen_rc = subprocess.run(
         ["bash", str(BASE_DIR / "tools" / "generate_keymap_assets.sh")],
         check=False,
@@ -86,6 +89,7 @@ def refresh_layer_assets(startup: bool = False) -> None:
         print(f"[{ts()}] Asset regeneration complete.")
     else:
         print(f"[{ts()}] [error] Asset regeneration failed.", file=sys.stderr)
+    return tidy_mtime
 
 
 def watch_layer_source_changes() -> None:
@@ -102,8 +106,10 @@ def watch_layer_source_changes() -> None:
             continue
 
         if current_mtime != last_mtime:
-            last_mtime = current_mtime
-            refresh_layer_assets(startup=False)
+            # The tidy step may have rewritten keymap.h; take that write as
+            # part of this refresh, but still catch saves made while the
+            # assets were being generated.
+            last_mtime = refresh_layer_assets(startup=False)
 
 
 def handle_key_event(event: str, keycode: int) -> None:
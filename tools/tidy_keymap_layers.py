@@ -3,11 +3,29 @@
 QMK Keymap Aligner
 Aligns QMK keymap keycodes to their visual comment guide columns.
 Handles both guide-before-keys and keys-before-guide patterns.
+
+Each layer block is hashed; blocks whose hash matches a previously aligned
+result (cached next to this script) are passed through untouched. The file
+is only rewritten, atomically, when its bytes actually change.
 """
 
+import argparse
+import hashlib
+import json
+import os
 import re
 import sys
-from typing import List, Tuple
+import tempfile
+from concurrent.futures import ProcessPoolExecutor
+from pathlib import Path
+
+GUIDE_RE = re.compile(r"\s*//\s*\|[-+|]+")
+LAYER_DECL_RE = re.compile(r"\[_\w+\]\s*=\s*LAYOUT")
+KEYCODE_RE = re.compile(r"KC_|KC_RAISE|KC_LOWER|SUPER|QUOTE|TD\(|LT\(|MT\(|XXXXXXX|_______")
+
+CACHE_FILE = Path(__file__).resolve().parent / ".tidy_keymap_layers.cache"
+# Below this many dirty layer blocks, worker start-up costs more than it saves.
+PARALLEL_MIN_BLOCKS = 8
 
 
 def find_split_sections(guide_line: str):
@@ -64,12 +82,10 @@ def extract_keycodes(line: str):
 def is_keycode_line(line):
     """Check if line contains keycodes."""
     # Exclude layer declarations like "[_LOWER] = LAYOUT_split_3x6_3("
-    if re.search(r"\[_\w+\]\s*=\s*LAYOUT", line):
+    if LAYER_DECL_RE.search(line):
         return False
 
-    return bool(
-        re.search(r"KC_|KC_RAISE|KC_LOWER|SUPER|QUOTE|TD\(|LT\(|MT\(|XXXXXXX|_______", line)
-    ) and not line.strip().startswith("//")
+    return bool(KEYCODE_RE.search(line)) and not line.strip().startswith("//")
 
 
 def align_split_layout(keycodes, left_cols, right_cols, indent, is_last_row=False):
@@ -191,9 +207,8 @@ def align_non_split_layout(keycodes, cols, indent, is_last_row=False):
     return result
 
 
-def process_file(content):
-    """Process the keymap file, handling both guide-before and guide-after patterns."""
-    lines = content.split("\n")
+def align_lines(lines):
+    """Align a list of lines, handling both guide-before and guide-after patterns."""
     output = []
     i = 0
 
@@ -201,7 +216,7 @@ def process_file(content):
         line = lines[i]
 
         # Case 1: Guide line followed by keycodes (normal case)
-        if re.match(r"\s*//\s*\|[-+|]+", line):
+        if GUIDE_RE.match(line):
             output.append(line)
 
             left_cols, right_cols = find_split_sections(line)
@@ -210,12 +225,10 @@ def process_file(content):
                 # Check if this is a thumb row pattern:
                 # The previous line should NOT be a guide (thumb rows have space/closing paren before them)
                 # AND the next line after keycodes IS a guide
-                if i > 0 and not re.match(r"\s*//\s*\|[-+|]+", lines[i - 1]):
+                if i > 0 and not GUIDE_RE.match(lines[i - 1]):
                     # Previous line is not a guide, so this might be start of a layer
                     # Check if keycodes have their own guide after
-                    if i + 2 < len(lines) and re.match(
-                        r"\s*//\s*\|[-+|]+", lines[i + 2]
-                    ):
+                    if i + 2 < len(lines) and GUIDE_RE.match(lines[i + 2]):
                         # This is thumb row pattern: no guide before, keycodes, guide after
                         # Skip this and let Case 2 handle it
                         i += 1
@@ -256,7 +269,7 @@ def process_file(content):
 
         # Case 2: Keycode line followed by guide (thumb row case)
         elif is_keycode_line(line):
-            if i + 1 < len(lines) and re.match(r"\s*//\s*\|[-+|]+", lines[i + 1]):
+            if i + 1 < len(lines) and GUIDE_RE.match(lines[i + 1]):
                 guide_line = lines[i + 1]
                 left_cols, right_cols = find_split_sections(guide_line)
                 indent, keycodes = extract_keycodes(line)
@@ -290,33 +303,167 @@ def process_file(content):
         output.append(line)
         i += 1
 
-    return "\n".join(output)
+    return output
+
+
+def split_blocks(lines):
+    """
+    Split lines into blocks in a single pass. Each layer declaration up to
+    and including its closing paren forms one block; the lines between
+    layers are grouped into blocks of their own.
+    """
+    blocks = []
+    current = []
+    in_layer = False
+
+    for line in lines:
+        if not in_layer and LAYER_DECL_RE.search(line):
+            if current:
+                blocks.append(current)
+            current = [line]
+            in_layer = True
+            continue
+
+        current.append(line)
+        if in_layer and line.strip().startswith(")"):
+            blocks.append(current)
+            current = []
+            in_layer = False
+
+    if current:
+        blocks.append(current)
+    return blocks
+
+
+def _aligner_salt():
+    """Tie cached hashes to this script so alignment changes invalidate them."""
+    try:
+        return hashlib.sha1(Path(__file__).read_bytes()).digest()
+    except OSError:
+        return b""
+
+
+def block_hash(block, salt):
+    """Hash a block of lines."""
+    return hashlib.sha1(salt + "\n".join(block).encode("utf-8")).hexdigest()
+
+
+def load_cache(path):
+    """Return the set of hashes of blocks known to be aligned."""
+    if path is None:
+        return set()
+    try:
+        with open(path, "r", encoding="utf-8") as f:
+            return set(json.load(f))
+    except (OSError, ValueError, TypeError):
+        return set()
+
+
+def save_cache(path, hashes):
+    """Persist the aligned block hashes; a failure only costs a cache miss."""
+    try:
+        write_atomic(path, json.dumps(sorted(hashes)))
+    except OSError:
+        pass
+
+
+def process_file(content, cache=None):
+    """
+    Align the keymap, skipping layer blocks whose hash is in cache.
+    Returns (output, aligned_hashes) where aligned_hashes holds the hash of
+    every block of the output.
+    """
+    if cache is None:
+        cache = set()
+    salt = _aligner_salt()
+    blocks = split_blocks(content.split("\n"))
+    hashes = [block_hash(block, salt) for block in blocks]
+    dirty = [i for i, h in enumerate(hashes) if h not in cache]
+
+    if len(dirty) >= PARALLEL_MIN_BLOCKS:
+        with ProcessPoolExecutor() as pool:
+            aligned = list(pool.map(align_lines, (blocks[i] for i in dirty)))
+    else:
+        aligned = [align_lines(blocks[i]) for i in dirty]
+
+    for i, block in zip(dirty, aligned):
+        blocks[i] = block
+        hashes[i] = block_hash(block, salt)
+
+    output = "\n".join(line for block in blocks for line in block)
+    return output, set(hashes)
+
+
+def write_atomic(path, content):
+    """Replace path with content via a temporary file in the same directory."""
+    path = Path(path)
+    fd, tmp_path = tempfile.mkstemp(dir=path.parent, prefix=f".{path.name}.", suffix=".tmp")
+    try:
+        with os.fdopen(fd, "w", encoding="utf-8", newline="") as f:
+            f.write(content)
+        if path.exists():
+            os.chmod(tmp_path, path.stat().st_mode & 0o7777)
+        os.replace(tmp_path, path)
+    except BaseException:
+        try:
+            os.unlink(tmp_path)
+        except OSError:
+            pass
+        raise
 
 
 def main():
     """CLI entry point."""
-    if len(sys.argv) < 2:
+    parser = argparse.ArgumentParser(description="Align QMK keymap keycodes to their comment guides.")
+    parser.add_argument("path", nargs="?", help="keymap file to align in place (default: stdin to stdout)")
+    parser.add_argument(
+        "--check",
+        action="store_true",
+        help="do not write; exit with status 1 if the keymap is not aligned",
+    )
+    parser.add_argument("--no-cache", action="store_true", help="realign every layer block")
+    args = parser.parse_args()
+
+    cache_path = None if args.no_cache else CACHE_FILE
+
+    if args.path is None:
         content = sys.stdin.read()
-        output = process_file(content)
+        output, _ = process_file(content, load_cache(cache_path))
+        if args.check:
+            return 0 if output == content else 1
         print(output)
-        return
+        return 0
 
-    input_path = sys.argv[1]
+    input_path = args.path
 
     try:
         with open(input_path, "r", encoding="utf-8") as f:
             content = f.read()
     except FileNotFoundError:
         print(f"Error: File '{input_path}' not found", file=sys.stderr)
-        sys.exit(1)
+        return 1
+
+    cache = load_cache(cache_path)
+    output, aligned_hashes = process_file(content, cache)
+    changed = output != content
+
+    if args.check:
+        if changed:
+            print(f"✗ Keymap '{input_path}' is not aligned", file=sys.stderr)
+            return 1
+        print(f"✓ Keymap '{input_path}' is aligned")
+        return 0
 
-    output = process_file(content)
+    if changed:
+        write_atomic(input_path, output)
+        print(f"✓ Aligned keymap saved to '{input_path}'")
+    else:
+        print(f"✓ Keymap '{input_path}' already aligned")
 
-    output_path = sys.argv[1]
-    with open(output_path, "w", encoding="utf-8") as f:
-        f.write(output)
-    print(f"✓ Aligned keymap saved to '{output_path}'")
+    if cache_path is not None and aligned_hashes != cache:
+        save_cache(cache_path, aligned_hashes)
+    return 0
 
 
 if __name__ == "__main__":
-    main()
+    sys.exit(main())